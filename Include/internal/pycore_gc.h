@@ -333,6 +333,8 @@ extern void _PyGC_CollectNoFail(PyThreadState *tstate);
 
 /* Freeze objects tracked by the GC and ignore them in future collections. */
 extern void _PyGC_Freeze(PyInterpreterState *interp);
+/* Makes frozen objects immortal and stops tracking them */
+extern void _PyGC_ImmortalizeFrozen(PyInterpreterState *interp);
 /* Unfreezes objects placing them in the oldest generation */
 extern void _PyGC_Unfreeze(PyInterpreterState *interp);
 /* Number of frozen objects */
@@ -496,6 +496,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(identity_hint)
         STRUCT_FOR_ID(ignore)
         STRUCT_FOR_ID(imag)
+        STRUCT_FOR_ID(immortalize)
         STRUCT_FOR_ID(importlib)
         STRUCT_FOR_ID(in_fd)
         STRUCT_FOR_ID(incoming)
@@ -680,6 +681,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(readonly)
         STRUCT_FOR_ID(real)
         STRUCT_FOR_ID(reducer_override)
+        STRUCT_FOR_ID(refs)
         STRUCT_FOR_ID(registry)
         STRUCT_FOR_ID(rel_tol)
         STRUCT_FOR_ID(release)
@@ -190,6 +190,12 @@ struct gc_generation_stats {
     Py_ssize_t collected;
     /* total number of uncollectable objects (put into gc.garbage) */
     Py_ssize_t uncollectable;
+    /* total time spent collecting this generation, in seconds */
+    double duration;
+#ifdef Py_GIL_DISABLED
+    /* part of duration spent with all other threads stopped */
+    double pause;
+#endif
 };
 
 enum _GCPhase {
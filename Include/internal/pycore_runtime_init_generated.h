@@ -1003,6 +1003,7 @@ extern "C" {
     INIT_ID(identity_hint), \
     INIT_ID(ignore), \
     INIT_ID(imag), \
+    INIT_ID(immortalize), \
     INIT_ID(importlib), \
     INIT_ID(in_fd), \
     INIT_ID(incoming), \
@@ -1187,6 +1188,7 @@ extern "C" {
     INIT_ID(readonly), \
     INIT_ID(real), \
     INIT_ID(reducer_override), \
+    INIT_ID(refs), \
     INIT_ID(registry), \
     INIT_ID(rel_tol), \
     INIT_ID(release), \
@@ -3649,6 +3649,49 @@ def test_framing_large_objects(self):
                     self.assertEqual(n_frames, 1)
                     self.check_frame_opcodes(pickled)
 
+    def test_fast_mode(self):
+        if not hasattr(self, 'pickler'):
+            self.skipTest('requires a Pickler')
+        item = [1, 'abc', 2.5, (b'xyz', None)]
+        obj = [item, item, {'key': item}, (item,)]
+        for proto in protocols:
+            with self.subTest(proto=proto):
+                buf = io.BytesIO()
+                pickler = self.pickler(buf, protocol=proto)
+                pickler.fast = True
+                pickler.dump(obj)
+                pickled = buf.getvalue()
+                self.assertEqual(count_opcode(pickle.MEMOIZE, pickled), 0)
+                self.assertEqual(count_opcode(pickle.BINPUT, pickled), 0)
+                self.assertEqual(count_opcode(pickle.PUT, pickled), 0)
+                unpickled = self.loads(pickled)
+                self.assertEqual(unpickled, obj)
+                # Shared objects are pickled as separate copies.
+                self.assertIsNot(unpickled[0], unpickled[1])
+
+                # Objects memoized before fast mode was enabled are still
+                # written as memo references.
+                buf = io.BytesIO()
+                pickler = self.pickler(buf, protocol=proto)
+                pickler.dump(item)
+                pickler.fast = True
+                pickler.dump([item, item])
+                buf.seek(0)
+                unpickler = self.unpickler(buf)
+                first = unpickler.load()
+                second = unpickler.load()
+                self.assertEqual(second, [item, item])
+                self.assertIs(second[0], first)
+                self.assertIs(second[1], first)
+
+                recursive = []
+                recursive.append(recursive)
+                pickler = self.pickler(io.BytesIO(), protocol=proto)
+                pickler.fast = True
+                with support.infinite_recursion(200), \
+                     self.assertRaises((ValueError, RecursionError)):
+                    pickler.dump(recursive)
+
     def test_optional_frames(self):
         if pickle.HIGHEST_PROTOCOL < 4:
             return
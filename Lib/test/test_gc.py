@@ -791,10 +791,17 @@ def test_get_stats(self):
         for st in stats:
             self.assertIsInstance(st, dict)
             self.assertEqual(set(st),
-                             {"collected", "collections", "uncollectable"})
+                             {"collected", "collections", "uncollectable",
+                              "duration", "pause"})
             self.assertGreaterEqual(st["collected"], 0)
             self.assertGreaterEqual(st["collections"], 0)
             self.assertGreaterEqual(st["uncollectable"], 0)
+            self.assertGreaterEqual(st["duration"], 0)
+            if Py_GIL_DISABLED:
+                self.assertGreaterEqual(st["pause"], 0)
+                self.assertLessEqual(st["pause"], st["duration"])
+            else:
+                self.assertIsNone(st["pause"])
         # Check that collection counts are incremented correctly
         if gc.isenabled():
             self.addCleanup(gc.enable)
@@ -810,6 +817,9 @@ def test_get_stats(self):
         self.assertEqual(new[0]["collections"], old[0]["collections"] + 1)
         self.assertEqual(new[1]["collections"], old[1]["collections"])
         self.assertEqual(new[2]["collections"], old[2]["collections"] + 1)
+        self.assertGreater(new[2]["duration"], old[2]["duration"])
+        if Py_GIL_DISABLED:
+            self.assertGreater(new[2]["pause"], old[2]["pause"])
 
     def test_freeze(self):
         gc.freeze()
@@ -817,6 +827,76 @@ def test_freeze(self):
         gc.unfreeze()
         self.assertEqual(gc.get_freeze_count(), 0)
 
+    def test_freeze_immortalize(self):
+        # Immortal objects are never freed, so run this in a subprocess.
+        code = textwrap.dedent("""
+            import gc
+            import sys
+
+            class C:
+                pass
+
+            a = C()
+            a.self = a
+            b = [a, {"key": (a,)}]
+            # The free-threaded build leaves uniquely referenced objects
+            # mortal, since they may still be under construction.
+            b2 = b
+            gc.freeze(immortalize=True)
+            print(sys._is_immortal(a), sys._is_immortal(b),
+                  sys._is_immortal(C))
+            print(gc.is_tracked(a), gc.is_tracked(b))
+
+            # Immortal objects can still be mutated and released.
+            b.append([b])
+            b[1]["key"] = None
+            del a, b, b2
+            gc.unfreeze()
+            gc.collect()
+        """)
+        rc, out, err = assert_python_ok("-c", code)
+        self.assertEqual(out.split(),
+                         [b"True", b"True", b"True", b"False", b"False"])
+
+    @threading_helper.requires_working_threading()
+    def test_freeze_immortalize_threads(self):
+        # Other threads may own objects that are being built while the
+        # world is stopped; immortalizing must not break them.
+        code = textwrap.dedent("""
+            import gc
+            import threading
+
+            def f():
+                gc.freeze(immortalize=True)
+                return 1
+
+            assert [f() for _ in range(3)] == [1, 1, 1]
+
+            done = threading.Event()
+
+            def build():
+                while not done.is_set():
+                    l = [[i] for i in range(100)]
+                    d = {i: [i] for i in range(100)}
+                    s = {(i,) for i in range(100)}
+                    l.extend(d.values())
+                    d.update({-1: l, -2: s})
+
+            threads = [threading.Thread(target=build) for _ in range(4)]
+            for t in threads:
+                t.start()
+            try:
+                for _ in range(50):
+                    gc.freeze(immortalize=True)
+            finally:
+                done.set()
+                for t in threads:
+                    t.join()
+            gc.unfreeze()
+            gc.collect()
+        """)
+        assert_python_ok("-c", code)
+
     def test_get_objects(self):
         gc.collect()
         l = []
@@ -25,6 +25,20 @@ def test_encode_basestring_ascii(self):
             self.assertEqual(result, expect,
                 f'{result!r} != {expect!r} for {fname}({input_string!r})')
 
+    def test_special_character_positions(self):
+        # The C implementation scans 1-byte strings several characters at a
+        # time, so place the characters which need escaping at every offset.
+        encoder = self.json.encoder
+        for n in range(40):
+            with self.subTest(n=n):
+                head = 'x' * n
+                self.assertEqual(
+                    encoder.encode_basestring_ascii(f'{head}"\x7f{head}\xe9'),
+                    f'"{head}\\"\\u007f{head}\\u00e9"')
+                self.assertEqual(
+                    encoder.encode_basestring(f'{head}\\\x7f{head}\x1f\xe9'),
+                    f'"{head}\\\\\x7f{head}\\u001f\xe9"')
+
     def test_ordered_dict(self):
         # See issue 6105
         items = [('one', 1), ('two', 2), ('three', 3), ('four', 4), ('five', 5)]
@@ -142,6 +142,25 @@ def test_bad_escapes(self):
             with self.assertRaises(self.JSONDecodeError, msg=s):
                 scanstring(s, 1, True)
 
+    def test_special_character_positions(self):
+        # The C implementation scans 1-byte strings several characters at a
+        # time, so place the character which ends a run at every offset.
+        scanstring = self.json.decoder.scanstring
+        for n in range(40):
+            with self.subTest(n=n):
+                head = 'x' * n
+                self.assertEqual(scanstring(f'"{head}"yz', 1, True),
+                                 (head, n + 2))
+                self.assertEqual(scanstring(f'"{head}\\n\xe9"', 1, True),
+                                 (head + '\n\xe9', n + 5))
+                self.assertEqual(scanstring(f'"{head}\t\x7f"', 1, False),
+                                 (head + '\t\x7f', n + 4))
+                with self.assertRaises(self.JSONDecodeError):
+                    scanstring(f'"{head}\t"', 1, True)
+                with self.assertRaises(self.JSONDecodeError) as cm:
+                    scanstring(f'"{head}', 1, True)
+                self.assertEqual(cm.exception.pos, 0)
+
     def test_overflow(self):
         with self.assertRaises(OverflowError):
             self.json.decoder.scanstring(b"xxx", sys.maxsize+1)
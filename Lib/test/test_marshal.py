@@ -359,6 +359,27 @@ def test_multiple_dumps_and_loads(self):
             finally:
                 os_helper.unlink(os_helper.TESTFN)
 
+    def test_loads_many(self):
+        data = (None, 1, 'abc', b'def', 1.0, (2, 'a', ['b', b'c']))
+        for refs in (True, False):
+            buf = b''.join(marshal.dumps(d, refs=refs) for d in data)
+            self.assertEqual(marshal.loads_many(buf), list(data))
+            self.assertEqual(marshal.loads_many(memoryview(buf)), list(data))
+            self.assertRaises(EOFError, marshal.loads_many, omit_last_byte(buf))
+        self.assertEqual(marshal.loads_many(b''), [])
+        # Reference indices restart with each value.
+        obj = [1.5, 'x']
+        buf = marshal.dumps([obj, obj]) * 2
+        first, second = marshal.loads_many(buf)
+        self.assertEqual(first, [obj, obj])
+        self.assertEqual(second, [obj, obj])
+        self.assertIs(second[0], second[1])
+        self.assertIsNot(first[0], second[0])
+        code = compile('x = 1', '<string>', 'exec')
+        buf = marshal.dumps(code)
+        self.assertEqual(len(marshal.loads_many(buf)), 1)
+        self.assertRaises(ValueError, marshal.loads_many, buf, allow_code=False)
+
     def test_loads_reject_unicode_strings(self):
         # Issue #14177: marshal.loads() should not accept unicode strings
         unicode_string = 'T'
@@ -562,6 +583,25 @@ def testRecursion(self):
         l.append(l)
         self.helper3(l, recursive=True)
 
+    def testNoRefs(self):
+        for obj in self.keys:
+            sample = [obj, obj]
+            for v in range(3, marshal.version + 1):
+                s = marshal.dumps(sample, v, refs=False)
+                self.assertEqual(marshal.loads(s), sample)
+                self.assertGreaterEqual(len(s), len(marshal.dumps(sample, v)))
+                f = io.BytesIO()
+                marshal.dump(sample, f, v, refs=False)
+                self.assertEqual(f.getvalue(), s)
+        # Without references, shared objects are loaded as copies.
+        obj = 123321
+        new = marshal.loads(marshal.dumps([obj, obj], refs=False))
+        self.assertIsNot(new[0], new[1])
+        # Recursive objects can only be written using references.
+        l = [obj]
+        l.append(l)
+        self.assertRaises(ValueError, marshal.dumps, l, refs=False)
+
 class CompatibilityTestCase(unittest.TestCase):
     def _test(self, version):
         with open(__file__, "rb") as f:
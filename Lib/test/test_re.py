@@ -1354,6 +1354,33 @@ def test_search_coverage(self):
         self.assertEqual(re.search(r"\s(b)", " b").group(1), "b")
         self.assertEqual(re.search(r"a\s", "a ").group(0), "a ")
 
+    def test_search_long_subject(self):
+        # Searches for a literal prefix or a leading charset scan ahead
+        # in bulk; check the boundaries of the scanned regions.
+        for n in (0, 1, 255, 256, 257, 1000, 5000):
+            for fill, target in (('x', 'a'), ('\xe9', '\xff'),
+                                 ('x', '\u0100'), ('x', '\U00010000')):
+                text = fill * n + target + 'b' + fill * 3 + target + 'c'
+                patterns = [
+                    (target, [n, n + 5]),
+                    (target + 'c', [n + 5]),
+                    (target + 'd', []),
+                    ('[%s]' % target, [n, n + 5]),
+                    ('[d%s]c' % target, [n + 5]),
+                    ('[d%s]d' % target, []),
+                ]
+                for pattern, expected in patterns:
+                    with self.subTest(n=n, pattern=pattern):
+                        self.assertEqual(
+                            [m.start() for m in re.finditer(pattern, text)],
+                            expected)
+                        if max(text) <= '\xff':
+                            self.assertEqual(
+                                [m.start() for m in
+                                 re.finditer(pattern.encode('latin-1'),
+                                             text.encode('latin-1'))],
+                                expected)
+
     def assertMatch(self, pattern, text, match=None, span=None,
                     matcher=re.fullmatch):
         if match is None and span is None:
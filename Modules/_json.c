@@ -110,6 +110,60 @@ encoder_encode_float(PyEncoderObject *s, PyObject *obj);
 #define S_CHAR(c) (c >= ' ' && c <= '~' && c != '\\' && c != '"')
 #define IS_WHITESPACE(c) (((c) == ' ') || ((c) == '\t') || ((c) == '\n') || ((c) == '\r'))
 
+/* Word-at-a-time scanning of 1-byte kind strings.  HAS_ZERO_BYTE() is
+   non-zero if any byte of v is zero and HAS_BYTE_LESS() if any byte of v
+   is less than n (n <= 128).  See "Determine if a word has a zero byte" in
+   https://graphics.stanford.edu/~seander/bithacks.html */
+#define UCS1_ONES (SIZE_MAX / 0xFF)
+#define UCS1_HIGH_BITS (UCS1_ONES * 0x80)
+#define HAS_ZERO_BYTE(v) (((v) - UCS1_ONES) & ~(v) & UCS1_HIGH_BITS)
+#define HAS_BYTE_LESS(v, n) (((v) - UCS1_ONES * (n)) & ~(v) & UCS1_HIGH_BITS)
+#define HAS_BYTE(v, c) HAS_ZERO_BYTE((v) ^ (UCS1_ONES * (c)))
+
+static inline int
+ucs1_is_special(Py_UCS1 c, int control, int nonascii)
+{
+    return (c == '"' || c == '\\' ||
+            (control && c <= 0x1f) ||
+            (nonascii && c >= 0x7f));
+}
+
+/* Return the index of the first character of s[start:end] which is a quote
+   or a backslash, or a control character if control is true, or DEL or a
+   non-ASCII character if nonascii is true.  Return end if there is none. */
+static inline Py_ssize_t
+ucs1_find_special(const Py_UCS1 *s, Py_ssize_t start, Py_ssize_t end,
+                  int control, int nonascii)
+{
+    const Py_UCS1 *p = s + start;
+    const Py_UCS1 *e = s + end;
+
+    while (p < e && !_Py_IS_ALIGNED(p, ALIGNOF_SIZE_T)) {
+        if (ucs1_is_special(*p, control, nonascii)) {
+            return p - s;
+        }
+        p++;
+    }
+    while (p + SIZEOF_SIZE_T <= e) {
+        size_t v = *(const size_t *)p;
+        size_t found = HAS_BYTE(v, '"') | HAS_BYTE(v, '\\');
+        if (control) {
+            found |= HAS_BYTE_LESS(v, 0x20);
+        }
+        if (nonascii) {
+            found |= (v & UCS1_HIGH_BITS) | HAS_BYTE(v, 0x7f);
+        }
+        if (found) {
+            break;
+        }
+        p += SIZEOF_SIZE_T;
+    }
+    while (p < e && !ucs1_is_special(*p, control, nonascii)) {
+        p++;
+    }
+    return p - s;
+}
+
 static Py_ssize_t
 ascii_escape_unichar(Py_UCS4 c, unsigned char *output, Py_ssize_t chars)
 {
@@ -165,6 +219,19 @@ ascii_escape_unicode(PyObject *pystr)
 
     /* Compute the output size */
     for (i = 0, output_size = 2; i < input_chars; i++) {
+        if (kind == PyUnicode_1BYTE_KIND) {
+            /* Skip the run of characters which are copied unchanged */
+            Py_ssize_t j = ucs1_find_special(input, i, input_chars, 1, 1);
+            if (output_size > PY_SSIZE_T_MAX - (j - i)) {
+                PyErr_SetString(PyExc_OverflowError, "string is too long to escape");
+                return NULL;
+            }
+            output_size += j - i;
+            i = j;
+            if (i == input_chars) {
+                break;
+            }
+        }
         Py_UCS4 c = PyUnicode_READ(kind, input, i);
         Py_ssize_t d;
         if (S_CHAR(c)) {
@@ -194,6 +261,15 @@ ascii_escape_unicode(PyObject *pystr)
     chars = 0;
     output[chars++] = '"';
     for (i = 0; i < input_chars; i++) {
+        if (kind == PyUnicode_1BYTE_KIND) {
+            Py_ssize_t j = ucs1_find_special(input, i, input_chars, 1, 1);
+            memcpy(output + chars, (const Py_UCS1 *)input + i, j - i);
+            chars += j - i;
+            i = j;
+            if (i == input_chars) {
+                break;
+            }
+        }
         Py_UCS4 c = PyUnicode_READ(kind, input, i);
         if (S_CHAR(c)) {
             output[chars++] = c;
@@ -229,6 +305,19 @@ escape_unicode(PyObject *pystr)
 
     /* Compute the output size */
     for (i = 0, output_size = 2; i < input_chars; i++) {
+        if (kind == PyUnicode_1BYTE_KIND) {
+            /* Skip the run of characters which are copied unchanged */
+            Py_ssize_t j = ucs1_find_special(input, i, input_chars, 1, 0);
+            if (output_size > PY_SSIZE_T_MAX - (j - i)) {
+                PyErr_SetString(PyExc_OverflowError, "string is too long to escape");
+                return NULL;
+            }
+            output_size += j - i;
+            i = j;
+            if (i == input_chars) {
+                break;
+            }
+        }
         Py_UCS4 c = PyUnicode_READ(kind, input, i);
         Py_ssize_t d;
         switch (c) {
@@ -259,6 +348,15 @@ escape_unicode(PyObject *pystr)
         chars = 0; \
         output[chars++] = '"'; \
         for (i = 0; i < input_chars; i++) { \
+            if (kind == PyUnicode_1BYTE_KIND) { \
+                Py_ssize_t j = ucs1_find_special(input, i, input_chars, 1, 0); \
+                memcpy(output + chars, (const Py_UCS1 *)input + i, j - i); \
+                chars += j - i; \
+                i = j; \
+                if (i == input_chars) { \
+                    break; \
+                } \
+            } \
             Py_UCS4 c = PyUnicode_READ(kind, input, i); \
             switch (c) { \
             case '\\': output[chars++] = '\\'; output[chars++] = c; break; \
@@ -404,7 +502,11 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
         {
             // Use tight scope variable to help register allocation.
             Py_UCS4 d = 0;
-            for (next = end; next < len; next++) {
+            next = end;
+            if (kind == PyUnicode_1BYTE_KIND) {
+                next = ucs1_find_special(buf, end, len, strict, 0);
+            }
+            for (; next < len; next++) {
                 d = PyUnicode_READ(kind, buf, next);
                 if (d == '"' || d == '\\') {
                     break;
@@ -347,6 +347,13 @@ repeat_pool_clear(SRE_STATE *state)
     }
 }
 
+/* When searching 8-bit strings for a pattern starting with a charset,
+   switch from evaluating the charset for each character to a 256-entry
+   lookup table once this many characters have been skipped.  Building the
+   table costs 256 evaluations, so this bounds its overhead on subjects with
+   many early matches. */
+#define SRE_CHARSET_TABLE_THRESHOLD 256
+
 /* generate 8-bit version */
 
 #define SRE_CHAR Py_UCS1
@@ -1753,10 +1753,16 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
         end = (SRE_CHAR *)state->end;
         state->must_advance = 0;
         while (ptr < end) {
+#if SIZEOF_SRE_CHAR == 1
+            ptr = (SRE_CHAR *)memchr(ptr, c, end - ptr);
+            if (ptr == NULL)
+                return 0;
+#else
             while (*ptr != c) {
                 if (++ptr >= end)
                     return 0;
             }
+#endif
             TRACE(("|%p|%p|SEARCH LITERAL\n", pattern, ptr));
             state->start = ptr;
             state->ptr = ptr + prefix_skip;
@@ -1786,10 +1792,17 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
 #endif
         while (ptr < end) {
             SRE_CHAR c = (SRE_CHAR) prefix[0];
+#if SIZEOF_SRE_CHAR == 1
+            ptr = (SRE_CHAR *)memchr(ptr, c, end - ptr);
+            if (ptr == NULL)
+                return 0;
+            ptr++;
+#else
             while (*ptr++ != c) {
                 if (ptr >= end)
                     return 0;
             }
+#endif
             if (ptr >= end)
                 return 0;
 
@@ -1826,9 +1839,37 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
         /* pattern starts with a character from a known set */
         end = (SRE_CHAR *)state->end;
         state->must_advance = 0;
+#if SIZEOF_SRE_CHAR == 1
+        unsigned char table[256];
+        int have_table = 0;
+        Py_ssize_t skipped = 0;
+#endif
         for (;;) {
+#if SIZEOF_SRE_CHAR == 1
+            if (!have_table) {
+                SRE_CHAR* start = ptr;
+                SRE_CHAR* stop = end;
+                if (end - ptr > SRE_CHARSET_TABLE_THRESHOLD - skipped)
+                    stop = ptr + (SRE_CHARSET_TABLE_THRESHOLD - skipped);
+                while (ptr < stop && !SRE(charset)(state, charset, *ptr))
+                    ptr++;
+                skipped += ptr - start;
+                if (ptr == stop && stop < end) {
+                    int ch;
+                    for (ch = 0; ch < 256; ch++)
+                        table[ch] = (unsigned char)SRE(charset)(state, charset,
+                                                                ch);
+                    have_table = 1;
+                }
+            }
+            if (have_table) {
+                while (ptr < end && !table[*ptr])
+                    ptr++;
+            }
+#else
             while (ptr < end && !SRE(charset)(state, charset, *ptr))
                 ptr++;
+#endif
             if (ptr >= end)
                 return 0;
             TRACE(("|%p|%p|SEARCH CHARSET\n", pattern, ptr));
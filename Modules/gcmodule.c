@@ -358,11 +358,25 @@ gc_get_stats_impl(PyObject *module)
     for (i = 0; i < NUM_GENERATIONS; i++) {
         PyObject *dict;
         st = &stats[i];
-        dict = Py_BuildValue("{snsnsn}",
+#ifdef Py_GIL_DISABLED
+        dict = Py_BuildValue("{snsnsnsdsd}",
+                             "collections", st->collections,
+                             "collected", st->collected,
+                             "uncollectable", st->uncollectable,
+                             "duration", st->duration,
+                             "pause", st->pause
+                            );
+#else
+        /* Other threads can run during a collection when the GIL is
+           released, so there is no stop-the-world pause to report. */
+        dict = Py_BuildValue("{snsnsnsdsO}",
                              "collections", st->collections,
                              "collected", st->collected,
-                             "uncollectable", st->uncollectable
+                             "uncollectable", st->uncollectable,
+                             "duration", st->duration,
+                             "pause", Py_None
                             );
+#endif
         if (dict == NULL)
             goto error;
         if (PyList_Append(result, dict)) {
@@ -416,19 +430,31 @@ gc_is_finalized_impl(PyObject *module, PyObject *obj)
 /*[clinic input]
 gc.freeze
 
+    *
+    immortalize: bool = False
+
 Freeze all current tracked objects and ignore them for future collections.
 
 This can be used before a POSIX fork() call to make the gc copy-on-write friendly.
 Note: collection before a POSIX fork() call may free pages for future allocation
 which can cause copy-on-write.
+
+If immortalize is true, the frozen objects are also made immortal and are
+untracked, so that reference count changes in child processes do not write
+to them either.  An immortal container is tracked again if a tracked object
+is later stored in it, until the next collection.  Immortal objects are
+never deallocated.
 [clinic start generated code]*/
 
 static PyObject *
-gc_freeze_impl(PyObject *module)
-/*[clinic end generated code: output=502159d9cdc4c139 input=b602b16ac5febbe5]*/
+gc_freeze_impl(PyObject *module, int immortalize)
+/*[clinic end generated code: output=db32b5465626796f input=9d3b90a08e4276e3]*/
 {
     PyInterpreterState *interp = _PyInterpreterState_GET();
     _PyGC_Freeze(interp);
+    if (immortalize) {
+        _PyGC_ImmortalizeFrozen(interp);
+    }
     Py_RETURN_NONE;
 }
 
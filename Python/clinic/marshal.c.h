@@ -9,7 +9,8 @@ preserve
 #include "pycore_modsupport.h"    // _PyArg_UnpackKeywords()
 
 PyDoc_STRVAR(marshal_dump__doc__,
-"dump($module, value, file, version=version, /, *, allow_code=True)\n"
+"dump($module, value, file, version=version, /, *, allow_code=True,\n"
+"     refs=True)\n"
 "--\n"
 "\n"
 "Write the value on the open file.\n"
@@ -22,6 +23,8 @@ PyDoc_STRVAR(marshal_dump__doc__,
 "    Indicates the data format that dump should use.\n"
 "  allow_code\n"
 "    Allow to write code objects.\n"
+"  refs\n"
+"    Share repeated references to the same object.\n"
 "\n"
 "If the value has (or contains an object that has) an unsupported type, a\n"
 "ValueError exception is raised - but garbage data will also be written\n"
@@ -32,7 +35,7 @@ PyDoc_STRVAR(marshal_dump__doc__,
 
 static PyObject *
 marshal_dump_impl(PyObject *module, PyObject *value, PyObject *file,
-                  int version, int allow_code);
+                  int version, int allow_code, int refs);
 
 static PyObject *
 marshal_dump(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
@@ -40,7 +43,7 @@ marshal_dump(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject
     PyObject *return_value = NULL;
     #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
 
-    #define NUM_KEYWORDS 1
+    #define NUM_KEYWORDS 2
     static struct {
         PyGC_Head _this_is_not_used;
         PyObject_VAR_HEAD
@@ -49,7 +52,7 @@ marshal_dump(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject
     } _kwtuple = {
         .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
         .ob_hash = -1,
-        .ob_item = { &_Py_ID(allow_code), },
+        .ob_item = { &_Py_ID(allow_code), &_Py_ID(refs), },
     };
     #undef NUM_KEYWORDS
     #define KWTUPLE (&_kwtuple.ob_base.ob_base)
@@ -58,19 +61,20 @@ marshal_dump(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject
     #  define KWTUPLE NULL
     #endif  // !Py_BUILD_CORE
 
-    static const char * const _keywords[] = {"", "", "", "allow_code", NULL};
+    static const char * const _keywords[] = {"", "", "", "allow_code", "refs", NULL};
     static _PyArg_Parser _parser = {
         .keywords = _keywords,
         .fname = "dump",
         .kwtuple = KWTUPLE,
     };
     #undef KWTUPLE
-    PyObject *argsbuf[4];
+    PyObject *argsbuf[5];
     Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 2;
     PyObject *value;
     PyObject *file;
     int version = Py_MARSHAL_VERSION;
     int allow_code = 1;
+    int refs = 1;
 
     args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
             /*minpos*/ 2, /*maxpos*/ 3, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
@@ -91,12 +95,21 @@ skip_optional_posonly:
     if (!noptargs) {
         goto skip_optional_kwonly;
     }
-    allow_code = PyObject_IsTrue(args[3]);
-    if (allow_code < 0) {
+    if (args[3]) {
+        allow_code = PyObject_IsTrue(args[3]);
+        if (allow_code < 0) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_kwonly;
+        }
+    }
+    refs = PyObject_IsTrue(args[4]);
+    if (refs < 0) {
         goto exit;
     }
 skip_optional_kwonly:
-    return_value = marshal_dump_impl(module, value, file, version, allow_code);
+    return_value = marshal_dump_impl(module, value, file, version, allow_code, refs);
 
 exit:
     return return_value;
@@ -183,7 +196,7 @@ exit:
 }
 
 PyDoc_STRVAR(marshal_dumps__doc__,
-"dumps($module, value, version=version, /, *, allow_code=True)\n"
+"dumps($module, value, version=version, /, *, allow_code=True, refs=True)\n"
 "--\n"
 "\n"
 "Return the bytes object that would be written to a file by dump(value, file).\n"
@@ -194,16 +207,22 @@ PyDoc_STRVAR(marshal_dumps__doc__,
 "    Indicates the data format that dumps should use.\n"
 "  allow_code\n"
 "    Allow to write code objects.\n"
+"  refs\n"
+"    Share repeated references to the same object.\n"
 "\n"
 "Raise a ValueError exception if value has (or contains an object that has) an\n"
-"unsupported type.");
+"unsupported type.\n"
+"\n"
+"Passing refs=False skips the bookkeeping needed to share references, which\n"
+"makes dumping faster when value does not contain the same object several\n"
+"times.  Shared objects are then written (and loaded back) as separate copies.");
 
 #define MARSHAL_DUMPS_METHODDEF    \
     {"dumps", _PyCFunction_CAST(marshal_dumps), METH_FASTCALL|METH_KEYWORDS, marshal_dumps__doc__},
 
 static PyObject *
 marshal_dumps_impl(PyObject *module, PyObject *value, int version,
-                   int allow_code);
+                   int allow_code, int refs);
 
 static PyObject *
 marshal_dumps(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
@@ -211,7 +230,7 @@ marshal_dumps(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObjec
     PyObject *return_value = NULL;
     #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
 
-    #define NUM_KEYWORDS 1
+    #define NUM_KEYWORDS 2
     static struct {
         PyGC_Head _this_is_not_used;
         PyObject_VAR_HEAD
@@ -220,7 +239,7 @@ marshal_dumps(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObjec
     } _kwtuple = {
         .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
         .ob_hash = -1,
-        .ob_item = { &_Py_ID(allow_code), },
+        .ob_item = { &_Py_ID(allow_code), &_Py_ID(refs), },
     };
     #undef NUM_KEYWORDS
     #define KWTUPLE (&_kwtuple.ob_base.ob_base)
@@ -229,18 +248,19 @@ marshal_dumps(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObjec
     #  define KWTUPLE NULL
     #endif  // !Py_BUILD_CORE
 
-    static const char * const _keywords[] = {"", "", "allow_code", NULL};
+    static const char * const _keywords[] = {"", "", "allow_code", "refs", NULL};
     static _PyArg_Parser _parser = {
         .keywords = _keywords,
         .fname = "dumps",
         .kwtuple = KWTUPLE,
     };
     #undef KWTUPLE
-    PyObject *argsbuf[3];
+    PyObject *argsbuf[4];
     Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 1;
     PyObject *value;
     int version = Py_MARSHAL_VERSION;
     int allow_code = 1;
+    int refs = 1;
 
     args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
             /*minpos*/ 1, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
@@ -260,12 +280,21 @@ skip_optional_posonly:
     if (!noptargs) {
         goto skip_optional_kwonly;
     }
-    allow_code = PyObject_IsTrue(args[2]);
-    if (allow_code < 0) {
+    if (args[2]) {
+        allow_code = PyObject_IsTrue(args[2]);
+        if (allow_code < 0) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_kwonly;
+        }
+    }
+    refs = PyObject_IsTrue(args[3]);
+    if (refs < 0) {
         goto exit;
     }
 skip_optional_kwonly:
-    return_value = marshal_dumps_impl(module, value, version, allow_code);
+    return_value = marshal_dumps_impl(module, value, version, allow_code, refs);
 
 exit:
     return return_value;
@@ -351,4 +380,88 @@ exit:
 
     return return_value;
 }
-/*[clinic end generated code: output=3e4bfc070a3c78ac input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(marshal_loads_many__doc__,
+"loads_many($module, bytes, /, *, allow_code=True)\n"
+"--\n"
+"\n"
+"Convert the bytes-like object to a list of consecutive values.\n"
+"\n"
+"  allow_code\n"
+"    Allow to load code objects.\n"
+"\n"
+"The input is expected to be the concatenation of the outputs of several\n"
+"dumps() calls.  Each value is decoded independently; this is equivalent to,\n"
+"but faster than, calling load() on an io.BytesIO object until it is exhausted.\n"
+"\n"
+"If the data is truncated or invalid, raise EOFError, ValueError or TypeError.");
+
+#define MARSHAL_LOADS_MANY_METHODDEF    \
+    {"loads_many", _PyCFunction_CAST(marshal_loads_many), METH_FASTCALL|METH_KEYWORDS, marshal_loads_many__doc__},
+
+static PyObject *
+marshal_loads_many_impl(PyObject *module, Py_buffer *bytes, int allow_code);
+
+static PyObject *
+marshal_loads_many(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        Py_hash_t ob_hash;
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_hash = -1,
+        .ob_item = { &_Py_ID(allow_code), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"", "allow_code", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "loads_many",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 1;
+    Py_buffer bytes = {NULL, NULL};
+    int allow_code = 1;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 1, /*maxpos*/ 1, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &bytes, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
+    allow_code = PyObject_IsTrue(args[1]);
+    if (allow_code < 0) {
+        goto exit;
+    }
+skip_optional_kwonly:
+    return_value = marshal_loads_many_impl(module, &bytes, allow_code);
+
+exit:
+    /* Cleanup for bytes */
+    if (bytes.obj) {
+       PyBuffer_Release(&bytes);
+    }
+
+    return return_value;
+}
+/*[clinic end generated code: output=ccf42ee66471b200 input=a9049054013a1b77]*/
@@ -1955,6 +1955,29 @@ _PyGC_Unfreeze(PyInterpreterState *interp)
     validate_spaces(gcstate);
 }
 
+void
+_PyGC_ImmortalizeFrozen(PyInterpreterState *interp)
+{
+    GCState *gcstate = &interp->gc;
+    PyGC_Head *permanent = &gcstate->permanent_generation.head;
+    PyGC_Head *gc = GC_NEXT(permanent);
+    while (gc != permanent) {
+        // _Py_SetImmortal() untracks the object, unlinking it from the list.
+        PyGC_Head *next = GC_NEXT(gc);
+        PyObject *op = FROM_GC(gc);
+#ifdef Py_REF_DEBUG
+        if (!_Py_IsImmortal(op)) {
+            /* Decrements of immortal objects are not registered, so
+               exclude the current reference count from the RefTotal. */
+            _Py_AddRefTotal(_PyThreadState_GET(), -Py_REFCNT(op));
+        }
+#endif
+        _Py_SetImmortal(op);
+        gc = next;
+    }
+    validate_spaces(gcstate);
+}
+
 Py_ssize_t
 _PyGC_GetFreezeCount(PyInterpreterState *interp)
 {
@@ -2030,6 +2053,9 @@ _PyGC_Collect(PyThreadState *tstate, int generation, _PyGC_Reason reason)
         PyDTrace_GC_START(generation);
     }
     PyObject *exc = _PyErr_GetRaisedException(tstate);
+    PyTime_t t1 = 0, t2 = 0;
+    // ignore errors: don't interrupt the GC if reading the clock fails
+    (void)PyTime_PerfCounterRaw(&t1);
     switch(generation) {
         case 0:
             gc_collect_young(tstate, &stats);
@@ -2043,6 +2069,9 @@ _PyGC_Collect(PyThreadState *tstate, int generation, _PyGC_Reason reason)
         default:
             Py_UNREACHABLE();
     }
+    (void)PyTime_PerfCounterRaw(&t2);
+    gcstate->generation_stats[generation].duration +=
+        PyTime_AsSecondsDouble(t2 - t1);
     if (PyDTrace_GC_DONE_ENABLED()) {
         PyDTrace_GC_DONE(stats.uncollectable + stats.collected);
     }
@@ -101,6 +101,9 @@ struct collection_state {
     Py_ssize_t collected;
     Py_ssize_t uncollectable;
     Py_ssize_t long_lived_total;
+    // Time spent with the world stopped during this collection.
+    PyTime_t pause;
+    PyTime_t pause_start;
     struct worklist unreachable;
     struct worklist legacy_finalizers;
     struct worklist wrcb_to_call;
@@ -2138,10 +2141,28 @@ record_deallocation(PyThreadState *tstate)
     }
 }
 
+// Stop and restart the world, accounting the time spent stopped as pause
+// time for gc.get_stats().
+static void
+gc_stop_the_world(struct collection_state *state)
+{
+    (void)PyTime_PerfCounterRaw(&state->pause_start);
+    _PyEval_StopTheWorld(state->interp);
+}
+
+static void
+gc_start_the_world(struct collection_state *state)
+{
+    _PyEval_StartTheWorld(state->interp);
+    PyTime_t now;
+    (void)PyTime_PerfCounterRaw(&now);
+    state->pause += now - state->pause_start;
+}
+
 static void
 gc_collect_internal(PyInterpreterState *interp, struct collection_state *state, int generation)
 {
-    _PyEval_StopTheWorld(interp);
+    gc_stop_the_world(state);
 
     // update collection and allocation counters
     if (generation+1 < NUM_GENERATIONS) {
@@ -2179,7 +2200,7 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
         // be ignored for rest of the GC pass.
         int err = gc_mark_alive_from_roots(interp, state);
         if (err < 0) {
-            _PyEval_StartTheWorld(interp);
+            gc_start_the_world(state);
             PyErr_NoMemory();
             return;
         }
@@ -2189,7 +2210,7 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
     // Find unreachable objects
     int err = deduce_unreachable_heap(interp, state);
     if (err < 0) {
-        _PyEval_StartTheWorld(interp);
+        gc_start_the_world(state);
         PyErr_NoMemory();
         return;
     }
@@ -2212,7 +2233,7 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
 
     // Clear weakrefs and enqueue callbacks (but do not call them).
     clear_weakrefs(state);
-    _PyEval_StartTheWorld(interp);
+    gc_start_the_world(state);
 
     // Deallocate any object from the refcount merge step
     cleanup_worklist(&state->objs_to_decref);
@@ -2223,11 +2244,11 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
     finalize_garbage(state);
 
     // Handle any objects that may have resurrected after the finalization.
-    _PyEval_StopTheWorld(interp);
+    gc_stop_the_world(state);
     err = handle_resurrected_objects(state);
     // Clear free lists in all threads
     _PyGC_ClearAllFreeLists(interp);
-    _PyEval_StartTheWorld(interp);
+    gc_start_the_world(state);
 
     if (err < 0) {
         cleanup_worklist(&state->unreachable);
@@ -2295,8 +2316,6 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
     if (gcstate->debug & _PyGC_DEBUG_STATS) {
         PySys_WriteStderr("gc: collecting generation %d...\n", generation);
         show_stats_each_generations(gcstate);
-        // ignore error: don't interrupt the GC if reading the clock fails
-        (void)PyTime_PerfCounterRaw(&t1);
     }
 
     if (PyDTrace_GC_START_ENABLED()) {
@@ -2311,15 +2330,19 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
         .reason = reason,
     };
 
+    // ignore error: don't interrupt the GC if reading the clock fails
+    (void)PyTime_PerfCounterRaw(&t1);
+
     gc_collect_internal(interp, &state, generation);
 
     m = state.collected;
     n = state.uncollectable;
 
+    PyTime_t t2;
+    (void)PyTime_PerfCounterRaw(&t2);
+    double d = PyTime_AsSecondsDouble(t2 - t1);
+
     if (gcstate->debug & _PyGC_DEBUG_STATS) {
-        PyTime_t t2;
-        (void)PyTime_PerfCounterRaw(&t2);
-        double d = PyTime_AsSecondsDouble(t2 - t1);
         PySys_WriteStderr(
             "gc: done, %zd unreachable, %zd uncollectable, %.4fs elapsed\n",
             n+m, n, d);
@@ -2343,6 +2366,8 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
     stats->collections++;
     stats->collected += m;
     stats->uncollectable += n;
+    stats->duration += d;
+    stats->pause += PyTime_AsSecondsDouble(state.pause);
 
     GC_STAT_ADD(generation, objects_collected, m);
 #ifdef Py_STATS
@@ -2521,6 +2546,48 @@ _PyGC_Freeze(PyInterpreterState *interp)
     _PyEval_StartTheWorld(interp);
 }
 
+static bool
+visit_immortalize(const mi_heap_t *heap, const mi_heap_area_t *area,
+                  void *block, size_t block_size, void *args)
+{
+    PyObject *op = op_from_block(block, args, true);
+    if (op == NULL || !gc_is_frozen(op) || _Py_IsImmortal(op)) {
+        return true;
+    }
+    if (_Py_REF_IS_QUEUED(op->ob_ref_shared)) {
+        // The owning thread will merge the reference count fields later,
+        // which requires the object to be mortal.
+        return true;
+    }
+    if (op->ob_tid != _Py_UNOWNED_TID && !_Py_IsOwnedByCurrentThread(op)) {
+        // Another thread owns the object and may rely on its local
+        // reference count or ownership, e.g. while building a container
+        // without locking it.  Leave it mortal.
+        return true;
+    }
+    if (Py_REFCNT(op) == 1) {
+        // Uniquely referenced objects may be under construction, and code
+        // that fills them in skips locking when the reference count is 1.
+        return true;
+    }
+#ifdef Py_REF_DEBUG
+    // Decrements of immortal objects are not registered, so exclude the
+    // current reference count from the RefTotal.
+    _Py_AddRefTotal(_PyThreadState_GET(), -Py_REFCNT(op));
+#endif
+    _Py_SetImmortal(op);
+    return true;
+}
+
+void
+_PyGC_ImmortalizeFrozen(PyInterpreterState *interp)
+{
+    struct visitor_args args;
+    _PyEval_StopTheWorld(interp);
+    gc_visit_heaps(interp, &visit_immortalize, &args);
+    _PyEval_StartTheWorld(interp);
+}
+
 static bool
 visit_unfreeze(const mi_heap_t *heap, const mi_heap_area_t *area,
                void *block, size_t block_size, void *args)
@@ -10,6 +10,7 @@
 #include "pycore_call.h"             // _PyObject_CallNoArgs()
 #include "pycore_code.h"             // _PyCode_New()
 #include "pycore_hashtable.h"        // _Py_hashtable_t
+#include "pycore_list.h"             // _PyList_AppendTakeRef()
 #include "pycore_long.h"             // _PyLong_IsZero()
 #include "pycore_pystate.h"          // _PyInterpreterState_GET()
 #include "pycore_setobject.h"        // _PySet_NextEntryRef()
@@ -248,7 +249,8 @@ w_short_pstring(const void *s, Py_ssize_t n, WFILE *p)
 } while(0)
 
 static PyObject *
-_PyMarshal_WriteObjectToString(PyObject *x, int version, int allow_code);
+_PyMarshal_WriteObjectToString(PyObject *x, int version, int allow_code,
+                               int refs);
 
 #define _r_digits(bitsize)                                                \
 static void                                                               \
@@ -606,7 +608,8 @@ w_complex_object(PyObject *v, char flag, WFILE *p)
         Py_BEGIN_CRITICAL_SECTION(v);
         while (_PySet_NextEntryRef(v, &pos, &value, &hash)) {
             PyObject *dump = _PyMarshal_WriteObjectToString(value,
-                                    p->version, p->allow_code);
+                                    p->version, p->allow_code,
+                                    p->hashtable != NULL);
             if (dump == NULL) {
                 p->error = WFERR_UNMARSHALLABLE;
                 Py_DECREF(value);
@@ -1834,7 +1837,8 @@ PyMarshal_ReadObjectFromString(const char *str, Py_ssize_t len)
 }
 
 static PyObject *
-_PyMarshal_WriteObjectToString(PyObject *x, int version, int allow_code)
+_PyMarshal_WriteObjectToString(PyObject *x, int version, int allow_code,
+                               int refs)
 {
     WFILE wf;
 
@@ -1850,7 +1854,8 @@ _PyMarshal_WriteObjectToString(PyObject *x, int version, int allow_code)
     wf.error = WFERR_OK;
     wf.version = version;
     wf.allow_code = allow_code;
-    if (w_init_refs(&wf, version)) {
+    /* Without the hashtable w_ref() writes every object in full. */
+    if (refs && w_init_refs(&wf, version)) {
         Py_DECREF(wf.str);
         return NULL;
     }
@@ -1889,7 +1894,7 @@ _PyMarshal_WriteObjectToString(PyObject *x, int version, int allow_code)
 PyObject *
 PyMarshal_WriteObjectToString(PyObject *x, int version)
 {
-    return _PyMarshal_WriteObjectToString(x, version, 1);
+    return _PyMarshal_WriteObjectToString(x, version, 1, 1);
 }
 
 /* And an interface for Python programs... */
@@ -1906,6 +1911,8 @@ marshal.dump
     *
     allow_code: bool = True
         Allow to write code objects.
+    refs: bool = True
+        Share repeated references to the same object.
 
 Write the value on the open file.
 
@@ -1916,14 +1923,14 @@ to the file. The object will not be properly read back by load().
 
 static PyObject *
 marshal_dump_impl(PyObject *module, PyObject *value, PyObject *file,
-                  int version, int allow_code)
-/*[clinic end generated code: output=429e5fd61c2196b9 input=041f7f6669b0aafb]*/
+                  int version, int allow_code, int refs)
+/*[clinic end generated code: output=61e313426f691463 input=8fd76bb54d3d012f]*/
 {
     /* XXX Quick hack -- need to do this differently */
     PyObject *s;
     PyObject *res;
 
-    s = _PyMarshal_WriteObjectToString(value, version, allow_code);
+    s = _PyMarshal_WriteObjectToString(value, version, allow_code, refs);
     if (s == NULL)
         return NULL;
     res = PyObject_CallMethodOneArg(file, &_Py_ID(write), s);
@@ -2004,19 +2011,25 @@ marshal.dumps
     *
     allow_code: bool = True
         Allow to write code objects.
+    refs: bool = True
+        Share repeated references to the same object.
 
 Return the bytes object that would be written to a file by dump(value, file).
 
 Raise a ValueError exception if value has (or contains an object that has) an
 unsupported type.
+
+Passing refs=False skips the bookkeeping needed to share references, which
+makes dumping faster when value does not contain the same object several
+times.  Shared objects are then written (and loaded back) as separate copies.
 [clinic start generated code]*/
 
 static PyObject *
 marshal_dumps_impl(PyObject *module, PyObject *value, int version,
-                   int allow_code)
-/*[clinic end generated code: output=115f90da518d1d49 input=167eaecceb63f0a8]*/
+                   int allow_code, int refs)
+/*[clinic end generated code: output=749d3cbba6a2bbbb input=06d0d8e9e2a8c509]*/
 {
-    return _PyMarshal_WriteObjectToString(value, version, allow_code);
+    return _PyMarshal_WriteObjectToString(value, version, allow_code, refs);
 }
 
 /*[clinic input]
@@ -2055,11 +2068,84 @@ marshal_loads_impl(PyObject *module, Py_buffer *bytes, int allow_code)
     return result;
 }
 
+/*[clinic input]
+marshal.loads_many
+
+    bytes: Py_buffer
+    /
+    *
+    allow_code: bool = True
+        Allow to load code objects.
+
+Convert the bytes-like object to a list of consecutive values.
+
+The input is expected to be the concatenation of the outputs of several
+dumps() calls.  Each value is decoded independently; this is equivalent to,
+but faster than, calling load() on an io.BytesIO object until it is exhausted.
+
+If the data is truncated or invalid, raise EOFError, ValueError or TypeError.
+[clinic start generated code]*/
+
+static PyObject *
+marshal_loads_many_impl(PyObject *module, Py_buffer *bytes, int allow_code)
+/*[clinic end generated code: output=8f4acab8f6c67e63 input=f77891a2a87a10a8]*/
+{
+    RFILE rf;
+    char *s = bytes->buf;
+    Py_ssize_t n = bytes->len;
+    PyObject *result, *v;
+
+    if (PySys_Audit("marshal.loads", "y#", s, n) < 0) {
+        return NULL;
+    }
+    result = PyList_New(0);
+    if (result == NULL) {
+        return NULL;
+    }
+    rf.allow_code = allow_code;
+    rf.fp = NULL;
+    rf.readable = NULL;
+    rf.ptr = s;
+    rf.end = s + n;
+    rf.depth = 0;
+    if ((rf.refs = PyList_New(0)) == NULL) {
+        Py_DECREF(result);
+        return NULL;
+    }
+    while (rf.ptr < rf.end) {
+        /* Reference indices are local to each value. */
+        if (PyList_GET_SIZE(rf.refs) != 0 &&
+            PyList_SetSlice(rf.refs, 0, PY_SSIZE_T_MAX, NULL) < 0)
+        {
+            goto error;
+        }
+        v = r_object(&rf);
+        if (v == NULL) {
+            if (!PyErr_Occurred()) {
+                PyErr_SetString(PyExc_TypeError,
+                                "NULL object in marshal data for object");
+            }
+            goto error;
+        }
+        if (_PyList_AppendTakeRef((PyListObject *)result, v) < 0) {
+            goto error;
+        }
+    }
+    Py_DECREF(rf.refs);
+    return result;
+
+error:
+    Py_DECREF(rf.refs);
+    Py_DECREF(result);
+    return NULL;
+}
+
 static PyMethodDef marshal_methods[] = {
     MARSHAL_DUMP_METHODDEF
     MARSHAL_LOAD_METHODDEF
     MARSHAL_DUMPS_METHODDEF
     MARSHAL_LOADS_METHODDEF
+    MARSHAL_LOADS_MANY_METHODDEF
     {NULL,              NULL}           /* sentinel */
 };
 
@@ -2091,7 +2177,8 @@ Functions:\n\
 dump() -- write value to a file\n\
 load() -- read value from a file\n\
 dumps() -- marshal value as a bytes object\n\
-loads() -- read value from a bytes-like object");
+loads() -- read value from a bytes-like object\n\
+loads_many() -- read consecutive values from a bytes-like object");
 
 
 static int
@@ -0,0 +1,252 @@
+"""
+Serialization performance test for record-oriented data.
+
+To install `pyperf` you would need to:
+
+    python3 -m pip install pyperf
+
+To run:
+
+    python3 Tools/scripts/serializeperf.py
+
+Options:
+
+    * `benchmark` name to run
+    * `--count` to set the number of records
+    * `--rng-seed` to set random seed
+    * `--pure-python` to disable the C accelerators of the serializers
+      (marshal has no pure Python implementation)
+
+Benchmarks are named `<serializer>_<operation>_<records>`, for example
+`json_loads_api_records`.  Each one dumps or loads a list of records of
+the same shape; the record generators are shared by all serializers.
+"""
+
+from __future__ import annotations
+
+import argparse
+import functools
+import io
+import random
+
+
+# ===============
+# Data generation
+# ===============
+
+WORDS = ["alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf",
+         "hotel", "india", "juliett", "kilo", "lima", "mike", "november"]
+
+
+def _sentence(rand: random.Random, nwords: int) -> str:
+    return " ".join(rand.choice(WORDS) for _ in range(nwords))
+
+
+def api_records(rand: random.Random) -> dict:
+    # A typical REST API response: small objects with short ASCII keys and
+    # values.
+    return {
+        "id": rand.randrange(1 << 32),
+        "name": _sentence(rand, 2).title(),
+        "active": rand.random() < 0.5,
+        "score": rand.random() * 100,
+        "tags": [rand.choice(WORDS) for _ in range(rand.randrange(5))],
+        "address": {"street": _sentence(rand, 3),
+                    "zip": "%05d" % rand.randrange(100000)},
+    }
+
+
+def rows(rand: random.Random) -> tuple:
+    # Rows of a typical database query result.
+    return (rand.randrange(1 << 32), rand.choice(WORDS) * 2, rand.random(),
+            rand.random() < 0.5, None)
+
+
+def log_lines(rand: random.Random) -> dict:
+    # Long ASCII messages, some containing characters which need escaping.
+    message = _sentence(rand, 30)
+    if rand.random() < 0.2:
+        message += '\n\tat "frame" \\ line %d' % rand.randrange(1000)
+    return {"level": rand.choice(["INFO", "WARN"]), "message": message}
+
+
+def latin1_text(rand: random.Random) -> dict:
+    # Long strings of 1-byte characters outside ASCII.
+    return {"title": _sentence(rand, 4),
+            "body": _sentence(rand, 40).replace("e", "\xe9")}
+
+
+def ucs2_text(rand: random.Random) -> dict:
+    # Long strings of 2-byte characters.
+    return {"title": _sentence(rand, 4),
+            "body": "".join(chr(rand.randrange(0x400, 0x4ff))
+                            for _ in range(200))}
+
+
+RECORDS = {
+    "api_records": api_records,
+    "rows": rows,
+    "log_lines": log_lines,
+    "latin1_text": latin1_text,
+    "ucs2_text": ucs2_text,
+}
+
+
+def make_records(name: str, count: int, seed: int) -> list:
+    rand = random.Random(seed)
+    make_record = RECORDS[name]
+    return [make_record(rand) for _ in range(count)]
+
+
+def hold_references(records: list) -> list:
+    # Live data is usually referenced from elsewhere too, which defeats the
+    # refcount shortcut that lets marshal.dumps() skip reference tracking
+    # for uniquely referenced objects.
+    held = []
+    stack = list(records)
+    while stack:
+        obj = stack.pop()
+        held.append(obj)
+        if isinstance(obj, dict):
+            stack.extend(obj.keys())
+            stack.extend(obj.values())
+        elif isinstance(obj, (list, tuple)):
+            stack.extend(obj)
+    return held
+
+
+# ===========
+# Serializers
+# ===========
+
+def _import(name: str, accelerator: str, pure_python: bool):
+    from test.support.import_helper import import_fresh_module
+
+    if pure_python:
+        return import_fresh_module(name, blocked=[accelerator])
+    return import_fresh_module(name, fresh=[accelerator])
+
+
+def json_benchmark(operation: str, records: list, pure_python: bool):
+    json = _import("json", "_json", pure_python)
+    if operation == "dumps":
+        return json.dumps, records
+    if operation == "dumps_utf8":
+        return functools.partial(json.dumps, ensure_ascii=False), records
+    assert operation == "loads", operation
+    return json.loads, json.dumps(records)
+
+
+def marshal_benchmark(operation: str, records: list, pure_python: bool):
+    import marshal
+
+    if operation == "dumps":
+        return marshal.dumps, records
+    if operation == "dumps_norefs":
+        return functools.partial(marshal.dumps, refs=False), records
+    if operation == "loads":
+        return marshal.loads, marshal.dumps(records)
+    assert operation == "loads_many", operation
+    return marshal.loads_many, b"".join(marshal.dumps(record, refs=False)
+                                        for record in records)
+
+
+def _pickle_dumps(pickle, fast: bool, obj) -> bytes:
+    f = io.BytesIO()
+    pickler = pickle.Pickler(f, pickle.HIGHEST_PROTOCOL)
+    pickler.fast = fast
+    pickler.dump(obj)
+    return f.getvalue()
+
+
+def pickle_benchmark(operation: str, records: list, pure_python: bool):
+    pickle = _import("pickle", "_pickle", pure_python)
+    if operation == "dumps":
+        return functools.partial(_pickle_dumps, pickle, False), records
+    if operation == "dumps_fast":
+        return functools.partial(_pickle_dumps, pickle, True), records
+    assert operation == "loads", operation
+    return pickle.loads, _pickle_dumps(pickle, False, records)
+
+
+SERIALIZERS = {
+    "json": (json_benchmark, ("dumps", "dumps_utf8", "loads")),
+    "marshal": (marshal_benchmark,
+                ("dumps", "dumps_norefs", "loads", "loads_many")),
+    "pickle": (pickle_benchmark, ("dumps", "dumps_fast", "loads")),
+}
+
+
+# =========
+# Benchmark
+# =========
+
+def add_cmdline_args(cmd: list[str], args) -> None:
+    if args.benchmark:
+        cmd.append(args.benchmark)
+    cmd.append(f"--count={args.count}")
+    cmd.append(f"--rng-seed={args.rng_seed}")
+    if args.pure_python:
+        cmd.append("--pure-python")
+
+
+def add_parser_args(parser: argparse.ArgumentParser) -> None:
+    parser.add_argument(
+        "benchmark",
+        choices=BENCHMARKS,
+        nargs="?",
+        help="Can be any of: {0}".format(", ".join(BENCHMARKS)),
+    )
+    parser.add_argument(
+        "--count",
+        type=int,
+        default=DEFAULT_COUNT,
+        help=f"Number of records (default: {DEFAULT_COUNT})",
+    )
+    parser.add_argument(
+        "--rng-seed",
+        type=int,
+        default=DEFAULT_RANDOM_SEED,
+        help=f"Random number generator seed (default: {DEFAULT_RANDOM_SEED})",
+    )
+    parser.add_argument(
+        "--pure-python",
+        action="store_true",
+        help="Benchmark the pure Python implementations",
+    )
+
+
+DEFAULT_COUNT = 1000
+DEFAULT_RANDOM_SEED = 0
+BENCHMARKS = {
+    f"{serializer}_{operation}_{records}": (serializer, operation, records)
+    for serializer, (_, operations) in SERIALIZERS.items()
+    for operation in operations
+    for records in RECORDS
+}
+
+if __name__ == "__main__":
+    # This needs `pyperf` 3rd party library:
+    import pyperf
+
+    runner = pyperf.Runner(add_cmdline_args=add_cmdline_args)
+    add_parser_args(runner.argparser)
+    args = runner.parse_args()
+
+    runner.metadata["description"] = "Test serialization of record lists"
+    runner.metadata["serialize_count"] = args.count
+    runner.metadata["serialize_random_seed"] = args.rng_seed
+    runner.metadata["serialize_pure_python"] = args.pure_python
+
+    if args.benchmark:
+        benchmarks = (args.benchmark,)
+    else:
+        benchmarks = BENCHMARKS
+    for bench in benchmarks:
+        serializer, operation, records = BENCHMARKS[bench]
+        make_benchmark, _ = SERIALIZERS[serializer]
+        data = make_records(records, args.count, args.rng_seed)
+        held = hold_references(data)
+        func, arg = make_benchmark(operation, data, args.pure_python)
+        runner.bench_func(bench, func, arg)
+        del held